@@ -72,6 +72,20 @@ TEST_CASE("Data.CSV.Parse")
             REQUIRE(tab.Rows[2, 0] == "OK");
         }
     }
+    SUBCASE("quoted newlines")
+    {
+        {
+            std::string csvString {"A,B,C\n1,\"multi, line\nnote\",3\n4,5,6"};
+
+            csv_table tab;
+            REQUIRE(tab.parse(csvString, {}));
+            REQUIRE(tab.Rows.height() == 2);
+            REQUIRE(tab.Rows.width() == 3);
+            REQUIRE(tab.Rows[1, 0] == "multi, line\nnote");
+            REQUIRE(tab.Rows[2, 0] == "3");
+            REQUIRE(tab.Rows[0, 1] == "4");
+        }
+    }
 }
 
 TEST_CASE("Data.CSV.Save")
@@ -0,0 +1,75 @@
+#include "bench.hpp"
+
+#include <string>
+
+using namespace tcob::data;
+
+static auto make_csv(i32 rowCount, bool quotedNewlines) -> std::string
+{
+    std::string retValue {"id,name,health,speed,damage,armor,cost,notes\n"};
+    for (i32 i {0}; i < rowCount; ++i) {
+        retValue += std::format("{},unit{},{},{:.3f},{},{},{:.2f},", i, i, 100 + i % 900, 1.5 + (i % 7) * 0.25, i % 50, i % 20, 9.99 * (i % 13));
+        retValue += quotedNewlines && i % 10 == 0 ? "\"multi, line\nnote\"" : "plain note";
+        retValue += '\n';
+    }
+    return retValue;
+}
+
+i32 const CSVRowCount {100'000};
+
+static bool const RegisterCSVParse {[] {
+    for (bool const quotedNewlines : {false, true}) {
+        std::string const name {quotedNewlines ? "Data.CSV.ParseQuotedNewlines" : "Data.CSV.Parse"};
+        bench::register_benchmark(name, [quotedNewlines](bench::state& state) {
+            std::string const text {make_csv(CSVRowCount, quotedNewlines)};
+
+            {
+                csv_table tab;
+                if (!tab.parse(text, {}) || tab.Rows.height() != CSVRowCount
+                    || tab.Rows[7, 0] != (quotedNewlines ? "multi, line\nnote" : "plain note")) {
+                    state.skip_with_error("csv parsed incorrectly");
+                    return;
+                }
+            }
+
+            while (state.keep_running()) {
+                csv_table tab;
+                if (!tab.parse(text, {})) {
+                    state.skip_with_error("could not parse csv");
+                    break;
+                }
+                bench::do_not_optimize(tab);
+            }
+
+            state.set_bytes_processed(state.iterations() * std::ssize(text));
+            state.set_items_processed(state.iterations() * CSVRowCount);
+        });
+    }
+    return true;
+}()};
+
+BENCHMARK_CASE("Data.CSV.LoadStream")
+{
+    std::string const text {make_csv(CSVRowCount, false)};
+    io::iomstream     stream {};
+    stream.write(text);
+
+    while (state.keep_running()) {
+        stream.seek(0, io::seek_dir::Begin);
+        csv_table tab;
+        if (!tab.load(stream, {})) {
+            state.skip_with_error("could not load csv");
+            break;
+        }
+
+        // typed column access, as a balance importer would do it
+        f64 sum {0};
+        for (i32 row {0}; row < tab.Rows.height(); ++row) {
+            sum += std::stod(tab.Rows[3, row]);
+        }
+        bench::do_not_optimize(sum);
+    }
+
+    state.set_bytes_processed(state.iterations() * std::ssize(text));
+    state.set_items_processed(state.iterations() * CSVRowCount);
+}
@@ -0,0 +1,603 @@
+#include "bench.hpp"
+
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace tcob::data;
+
+static auto make_document(i32 sectionCount, i32 keyCount) -> object
+{
+    object retValue;
+
+    for (i32 s {0}; s < sectionCount; ++s) {
+        std::string const section {"section" + std::to_string(s)};
+
+        for (i32 k {0}; k < keyCount; ++k) {
+            std::string const key {std::to_string(k)};
+            retValue[section]["valueBool" + key]  = k % 2 == 0;
+            retValue[section]["valueInt" + key]   = k * 1000 + s;
+            retValue[section]["valueFloat" + key] = static_cast<f64>(k) * 1.25 + static_cast<f64>(s);
+            retValue[section]["valueStr" + key]   = "test" + key;
+        }
+
+        retValue[section]["valueSection"]["a"]               = s;
+        retValue[section]["valueSection"]["b"]               = "a";
+        retValue[section]["valueSection"]["subsection"]["a"] = 100;
+
+        array arr;
+        for (i32 i {0}; i < keyCount; ++i) { arr.add(i); }
+        retValue[section]["valueArray"] = arr;
+    }
+
+    return retValue;
+}
+
+// Number of entries make_document creates: per section keyCount * 4 scalars, valueSection
+// with a, b, subsection and subsection.a, and valueArray with its keyCount elements.
+static constexpr auto document_item_count(i32 sectionCount, i32 keyCount) -> i64
+{
+    return static_cast<i64>(sectionCount) * (keyCount * 4 + 5 + 1 + keyCount);
+}
+
+struct config_format {
+    std::string Name;
+    std::string Extension;
+};
+
+static std::array<config_format, 4> const ConfigFormats {{
+    {.Name = "Json", .Extension = ".json"},
+    {.Name = "Yaml", .Extension = ".yaml"},
+    {.Name = "XML", .Extension = ".xml"},
+    {.Name = "Ini", .Extension = ".ini"},
+}};
+
+static bool const RegisterConfigLoad {[] {
+    for (auto const& format : ConfigFormats) {
+        bench::register_benchmark("Data." + format.Name + ".Load", [ext = format.Extension](bench::state& state) {
+            std::string const file {"bench" + ext};
+            io::delete_file(file);
+            if (!make_document(64, 32).save(file)) {
+                state.skip_with_error("could not save " + file);
+                return;
+            }
+            auto const fileBytes {static_cast<i64>(io::get_file_size(file))};
+
+            while (state.keep_running()) {
+                object obj;
+                if (!obj.load(file)) {
+                    state.skip_with_error("could not load " + file);
+                    break;
+                }
+                bench::do_not_optimize(obj);
+            }
+
+            state.set_bytes_processed(state.iterations() * fileBytes);
+            io::delete_file(file);
+        });
+    }
+    return true;
+}()};
+
+static auto make_document_text(auto const& doc, std::string const& ext) -> std::string
+{
+    io::iomstream stream {};
+    if (!doc.save(stream, ext)) { return {}; }
+
+    stream.seek(0, io::seek_dir::Begin);
+    return stream.read_string(stream.size_in_bytes());
+}
+
+static bool const RegisterConfigParse {[] {
+    for (auto const& format : ConfigFormats) {
+        bench::register_benchmark("Data." + format.Name + ".Parse", [ext = format.Extension](bench::state& state) {
+            std::string const text {make_document_text(make_document(256, 64), ext)};
+            if (text.empty()) {
+                state.skip_with_error("could not generate " + ext + " document");
+                return;
+            }
+
+            while (state.keep_running()) {
+                object obj;
+                if (!obj.parse(text, ext)) {
+                    state.skip_with_error("could not parse " + ext + " document");
+                    break;
+                }
+                bench::do_not_optimize(obj);
+            }
+
+            state.set_bytes_processed(state.iterations() * std::ssize(text));
+        });
+    }
+    return true;
+}()};
+
+BENCHMARK_CASE("Data.Json.TestSuite")
+{
+    auto const               found {io::enumerate("testfiles/json/", {.String = "*.json"}, false)};
+    std::vector<std::string> texts;
+    i64                      textBytes {0};
+    for (auto const& file : found) {
+        texts.push_back(io::read_as_string(file));
+        textBytes += std::ssize(texts.back());
+    }
+    if (texts.empty()) {
+        state.skip_with_error("no test files");
+        return;
+    }
+
+    while (state.keep_running()) {
+        for (auto const& text : texts) {
+            object obj;
+            auto   objStatus {obj.parse(text, ".json")};
+            array  arr;
+            auto   arrStatus {arr.parse(text, ".json")};
+            bench::do_not_optimize(objStatus);
+            bench::do_not_optimize(arrStatus);
+        }
+    }
+
+    state.set_bytes_processed(state.iterations() * textBytes);
+    state.set_items_processed(state.iterations() * std::ssize(texts));
+}
+
+BENCHMARK_CASE("Data.Json.ParseReadFew")
+{
+    std::string const text {make_document_text(make_document(256, 64), ".json")};
+    if (text.empty()) {
+        state.skip_with_error("could not generate document");
+        return;
+    }
+
+    while (state.keep_running()) {
+        object obj;
+        if (!obj.parse(text, ".json")) {
+            state.skip_with_error("could not parse document");
+            break;
+        }
+
+        i64 sum {0};
+        sum += obj["section0"]["valueInt0"].as<i64>();
+        sum += obj["section128"]["valueSection"]["subsection"]["a"].as<i64>();
+        sum += obj["section255"]["valueInt63"].as<i64>();
+        bench::do_not_optimize(sum);
+    }
+
+    state.set_bytes_processed(state.iterations() * std::ssize(text));
+}
+
+BENCHMARK_CASE("Data.Json.ParseReadAll")
+{
+    i32 const         sectionCount {256};
+    i32 const         keyCount {64};
+    std::string const text {make_document_text(make_document(sectionCount, keyCount), ".json")};
+    if (text.empty()) {
+        state.skip_with_error("could not generate document");
+        return;
+    }
+
+    std::vector<std::string> sectionKeys;
+    for (i32 s {0}; s < sectionCount; ++s) { sectionKeys.push_back("section" + std::to_string(s)); }
+    std::vector<std::string> intKeys;
+    for (i32 k {0}; k < keyCount; ++k) { intKeys.push_back("valueInt" + std::to_string(k)); }
+
+    while (state.keep_running()) {
+        object obj;
+        if (!obj.parse(text, ".json")) {
+            state.skip_with_error("could not parse document");
+            break;
+        }
+
+        i64 sum {0};
+        for (auto const& sectionKey : sectionKeys) {
+            object section {obj[sectionKey].as<object>()};
+            for (auto const& intKey : intKeys) {
+                sum += section[intKey].as<i64>();
+            }
+
+            sum += section["valueSection"]["a"].as<i64>();
+            sum += section["valueSection"]["subsection"]["a"].as<i64>();
+
+            array arr {section["valueArray"].as<array>()};
+            for (i32 i {0}; i < keyCount; ++i) {
+                sum += arr[i].as<i64>();
+            }
+        }
+        bench::do_not_optimize(sum);
+    }
+
+    state.set_bytes_processed(state.iterations() * std::ssize(text));
+}
+
+BENCHMARK_CASE("Data.Config.Build")
+{
+    i32 const sectionCount {64};
+    i32 const keyCount {32};
+
+    while (state.keep_running()) {
+        object obj {make_document(sectionCount, keyCount)};
+        bench::do_not_optimize(obj);
+    }
+
+    state.set_items_processed(state.iterations() * document_item_count(sectionCount, keyCount));
+}
+
+BENCHMARK_CASE("Data.Config.CloneDeep")
+{
+    i32 const sectionCount {64};
+    i32 const keyCount {32};
+    object    original {make_document(sectionCount, keyCount)};
+
+    while (state.keep_running()) {
+        object clone {original.clone(true)};
+        bench::do_not_optimize(clone);
+    }
+
+    state.set_items_processed(state.iterations() * document_item_count(sectionCount, keyCount));
+}
+
+BENCHMARK_CASE("Data.Config.Access.Chain")
+{
+    object t {make_document(64, 32)};
+
+    while (state.keep_running()) {
+        i64 sum {0};
+        sum += t["section1"]["valueInt3"].as<i64>();
+        sum += t["section1"]["valueSection"]["a"].as<i64>();
+        sum += t["section42"]["valueSection"]["subsection"]["a"].as<i64>();
+        sum += t["section63"]["valueBool0"].as<bool>() ? 1 : 0;
+        sum += std::ssize(t["section2"]["valueStr7"].as<std::string>());
+        bench::do_not_optimize(sum);
+    }
+
+    state.set_items_processed(state.iterations() * 5);
+}
+
+BENCHMARK_CASE("Data.Config.Access.TryGet")
+{
+    object t {make_document(64, 32)};
+
+    while (state.keep_running()) {
+        bool b {false};
+        i64  i {0};
+        bench::do_not_optimize(t.try_get<bool>(b, "section1", "valueBool0"));
+        bench::do_not_optimize(t.try_get<i64>(i, "section1", "valueSection", "subsection", "a"));
+        bench::do_not_optimize(t.try_get<i64>(i, "section1", "valueMissing"));
+        bench::do_not_optimize(t.try_get<bool>(b, "section1", "valueFloat0"));
+    }
+
+    state.set_items_processed(state.iterations() * 4);
+}
+
+BENCHMARK_CASE("Data.Config.Access.Assign")
+{
+    while (state.keep_running()) {
+        object t;
+        for (i32 i {0}; i < 256; ++i) {
+            std::string const section {"section" + std::to_string(i % 16)};
+            t[section]["valueBool"] = i % 2 == 0;
+            t[section]["x"]         = i;
+            t[section]["y"]         = -i;
+        }
+        bench::do_not_optimize(t);
+    }
+
+    state.set_items_processed(state.iterations() * 256 * 3);
+}
+
+static auto make_records(i32 recordCount) -> array
+{
+    array retValue;
+    for (i32 i {0}; i < recordCount; ++i) {
+        object record;
+        record["id"]        = i;
+        record["timestamp"] = 1'700'000'000 + i;
+        record["event"]     = i % 3 == 0 ? "spawn" : "move";
+        record["x"]         = static_cast<f64>(i) * 0.5;
+        record["y"]         = static_cast<f64>(i) * -0.25;
+        record["ok"]        = i % 2 == 0;
+        retValue.add(record);
+    }
+    return retValue;
+}
+
+static bool const RegisterRecordParse {[] {
+    for (auto const& format : ConfigFormats) {
+        if (format.Extension != ".json" && format.Extension != ".xml") { continue; }
+
+        bench::register_benchmark("Data." + format.Name + ".ParseRecords", [ext = format.Extension](bench::state& state) {
+            std::string const text {make_document_text(make_records(50'000), ext)};
+            if (text.empty()) {
+                state.skip_with_error("could not generate " + ext + " records");
+                return;
+            }
+
+            while (state.keep_running()) {
+                array arr;
+                if (!arr.parse(text, ext)) {
+                    state.skip_with_error("could not parse " + ext + " records");
+                    break;
+                }
+                bench::do_not_optimize(arr);
+            }
+
+            state.set_bytes_processed(state.iterations() * std::ssize(text));
+            state.set_items_processed(state.iterations() * 50'000);
+        });
+    }
+    return true;
+}()};
+
+BENCHMARK_CASE("Data.Binary.Load")
+{
+    std::vector<std::byte> buffer;
+    {
+        io::iomstream stream {};
+        if (!make_document(256, 64).save(stream, ".bsbd")) {
+            state.skip_with_error("could not generate binary document");
+            return;
+        }
+
+        stream.seek(0, io::seek_dir::Begin);
+        auto const data {stream.read_all<u8>()};
+        auto const bytes {std::as_bytes(std::span {data})};
+        buffer.assign(bytes.begin(), bytes.end());
+    }
+
+    while (state.keep_running()) {
+        io::isstream stream {buffer};
+        object       obj;
+        if (!obj.load(stream, ".bsbd")) {
+            state.skip_with_error("could not load binary document");
+            break;
+        }
+        bench::do_not_optimize(obj);
+    }
+
+    state.set_bytes_processed(state.iterations() * std::ssize(buffer));
+}
+
+BENCHMARK_CASE("Data.Config.Schema.Validate")
+{
+    auto stats {std::make_shared<schema>()};
+    stats->AllOf = {
+        schema::int_property {.Name = "health", .MinValue = 1, .MaxValue = 1000},
+        schema::float_property {.Name = "speed", .MinValue = 0.f, .MaxValue = 10.f},
+    };
+
+    schema s0;
+    s0.AllOf = {
+        schema::string_property {.Name = "name"},
+        schema::bool_property {.Name = "enabled"},
+        schema::array_property {.Name = "tags", .MinSize = 1, .MaxSize = 8, .ItemType = type::String},
+        schema::object_property {.Name = "stats", .Schema = stats},
+    };
+    s0.AnyOf = {
+        schema::string_property {.Name = "author"},
+        schema::int_property {.Name = "version"},
+    };
+
+    std::vector<object> mods;
+    for (i32 i {0}; i < 1'000; ++i) {
+        object mod;
+        mod["name"]    = "mod" + std::to_string(i);
+        mod["enabled"] = i % 2 == 0;
+        array tags;
+        tags.add("content");
+        tags.add("balance");
+        mod["tags"]            = tags;
+        mod["stats"]["health"] = i % 10 == 0 ? 0 : 100 + i % 900; // every 10th mod is invalid
+        mod["stats"]["speed"]  = 2.5f;
+        mod["version"]         = i;
+        mods.push_back(mod);
+    }
+
+    auto const validate_all {[&] {
+        i32 retValue {0};
+        for (auto& mod : mods) {
+            if (s0.validate(mod)) { ++retValue; }
+        }
+        return retValue;
+    }};
+
+    if (validate_all() != 900) {
+        state.skip_with_error("unexpected number of valid mods");
+        return;
+    }
+
+    while (state.keep_running()) {
+        i32 const valid {validate_all()};
+        bench::do_not_optimize(valid);
+    }
+
+    state.set_items_processed(state.iterations() * std::ssize(mods));
+}
+
+struct bench_entity {
+    std::string Name;
+    i32         Health {0};
+    f32         Speed {0};
+    bool        Hostile {false};
+    point_f     Spawn;
+};
+
+BENCHMARK_CASE("Data.Json.ParseIntoStructs")
+{
+    i32 const entityCount {5'000};
+
+    array defs;
+    for (i32 i {0}; i < entityCount; ++i) {
+        object def;
+        def["name"]    = "entity" + std::to_string(i);
+        def["health"]  = 100 + i;
+        def["speed"]   = 1.5f;
+        def["hostile"] = i % 2 == 0;
+        def["spawn"]   = point_f {static_cast<f32>(i), static_cast<f32>(-i)};
+        defs.add(def);
+    }
+
+    std::string const text {make_document_text(defs, ".json")};
+    if (text.empty()) {
+        state.skip_with_error("could not generate entities");
+        return;
+    }
+    if (array arr; !arr.parse(text, ".json") || arr.size() != entityCount) {
+        state.skip_with_error("unexpected number of entities");
+        return;
+    }
+
+    std::vector<bench_entity> entities;
+    entities.reserve(entityCount);
+
+    while (state.keep_running()) {
+        entities.clear();
+
+        array arr;
+        if (!arr.parse(text, ".json")) {
+            state.skip_with_error("could not parse entities");
+            break;
+        }
+
+        for (i32 i {0}; i < entityCount; ++i) {
+            object def {arr[i].as<object>()};
+            entities.push_back({
+                .Name    = def["name"].as<std::string>(),
+                .Health  = def["health"].as<i32>(),
+                .Speed   = def["speed"].as<f32>(),
+                .Hostile = def["hostile"].as<bool>(),
+                .Spawn   = def["spawn"].as<point_f>(),
+            });
+        }
+        bench::do_not_optimize(entities);
+    }
+
+    state.set_bytes_processed(state.iterations() * std::ssize(text));
+    state.set_items_processed(state.iterations() * entityCount);
+}
+
+BENCHMARK_CASE("Data.Config.LoadMerge")
+{
+    i32 const fileCount {200};
+
+    std::array<std::string, 3> const extensions {".json", ".yaml", ".ini"};
+    std::vector<std::string>         files;
+    for (i32 i {0}; i < fileCount; ++i) {
+        object layer {make_document(8, 16)};
+        layer["section0"]["layer"] = i;
+
+        std::string const file {"benchLayer" + std::to_string(i) + extensions[i % extensions.size()]};
+        io::delete_file(file);
+        if (!layer.save(file)) {
+            state.skip_with_error("could not save " + file);
+            return;
+        }
+        files.push_back(file);
+    }
+
+    while (state.keep_running()) {
+        object merged;
+        for (auto const& file : files) {
+            object layer;
+            if (!layer.load(file)) {
+                state.skip_with_error("could not load " + file);
+                break;
+            }
+            merged.merge(layer, true);
+        }
+        bench::do_not_optimize(merged);
+    }
+
+    state.set_items_processed(state.iterations() * fileCount);
+    for (auto const& file : files) { io::delete_file(file); }
+}
+
+BENCHMARK_CASE("Data.Config.SyncFull")
+{
+    object server {make_document(256, 64)};
+    object client;
+
+    i64 bytes {0};
+    i32 tick {0};
+    while (state.keep_running()) {
+        server["section17"]["valueInt3"] = tick++;
+
+        io::iomstream stream {};
+        if (!server.save(stream, ".json")) {
+            state.skip_with_error("could not save world state");
+            break;
+        }
+        bytes += static_cast<i64>(stream.size_in_bytes());
+
+        stream.seek(0, io::seek_dir::Begin);
+        if (!client.load(stream, ".json")) {
+            state.skip_with_error("could not load world state");
+            break;
+        }
+    }
+    bench::do_not_optimize(client);
+
+    state.set_bytes_processed(bytes);
+}
+
+static auto make_numeric_document(i32 sectionCount, i32 keyCount) -> object
+{
+    object retValue;
+    for (i32 s {0}; s < sectionCount; ++s) {
+        std::string const section {"section" + std::to_string(s)};
+        for (i32 k {0}; k < keyCount; ++k) {
+            std::string const key {std::to_string(k)};
+            retValue[section]["f" + key] = static_cast<f64>(s * keyCount + k) / 7.0 + 0.1;
+            retValue[section]["i" + key] = static_cast<i64>(s) * 1'000'003 - k;
+        }
+    }
+    return retValue;
+}
+
+static bool const RegisterConfigSave {[] {
+    for (auto const& format : ConfigFormats) {
+        bench::register_benchmark("Data." + format.Name + ".Save", [ext = format.Extension](bench::state& state) {
+            object doc {make_numeric_document(128, 64)};
+
+            i64 bytes {0};
+            while (state.keep_running()) {
+                io::iomstream stream {};
+                if (!doc.save(stream, ext)) {
+                    state.skip_with_error("could not save " + ext + " document");
+                    break;
+                }
+                bytes += static_cast<i64>(stream.size_in_bytes());
+            }
+
+            state.set_bytes_processed(bytes);
+            state.set_items_processed(state.iterations() * 128 * 64 * 2);
+        });
+    }
+    return true;
+}()};
+
+BENCHMARK_CASE("Data.Json.SaveFile")
+{
+    object            doc {make_document(1024, 64)};
+    std::string const file {"benchSave.json"};
+
+    i64 bytes {0};
+    while (state.keep_running()) {
+        {
+            io::ofstream fs {file};
+            if (!doc.save(fs, ".json")) {
+                state.skip_with_error("could not save " + file);
+                break;
+            }
+        }
+
+        state.pause_timing();
+        bytes += static_cast<i64>(io::get_file_size(file));
+        io::delete_file(file);
+        state.resume_timing();
+    }
+
+    state.set_bytes_processed(bytes);
+    io::delete_file(file);
+}
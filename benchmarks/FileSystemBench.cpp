@@ -0,0 +1,121 @@
+#include "bench.hpp"
+
+#include <string>
+#include <vector>
+
+i32 const ZipFileCount {2'000};
+
+static void create_zip_source(std::string const& folder)
+{
+    io::delete_folder(folder);
+    io::create_folder(folder);
+    for (i32 i {0}; i < ZipFileCount; ++i) {
+        std::string content;
+        for (i32 j {0}; j < 16; ++j) { content += std::format("entry{}:line{};", i, j); }
+        io::ofstream {std::format("{}/file{}.txt", folder, i)}.write(content);
+    }
+}
+
+BENCHMARK_CASE("IO.FileSystem.Zip")
+{
+    std::string const folder {"benchZipFolder"};
+    std::string const file {"benchZip.zip"};
+    create_zip_source(folder);
+
+    while (state.keep_running()) {
+        io::ofstream out {file};
+        if (!io::zip(folder, out)) {
+            state.skip_with_error("zip failed");
+            break;
+        }
+    }
+
+    state.set_items_processed(state.iterations() * ZipFileCount);
+    io::delete_folder(folder);
+    io::delete_file(file);
+}
+
+BENCHMARK_CASE("IO.FileSystem.Unzip")
+{
+    std::string const folder {"benchZipFolder"};
+    std::string const target {"benchUnzipFolder"};
+    std::string const file {"benchZip.zip"};
+    create_zip_source(folder);
+    {
+        io::ofstream out {file};
+        if (!io::zip(folder, out)) {
+            state.skip_with_error("zip failed");
+            return;
+        }
+    }
+    io::delete_folder(folder);
+
+    while (state.keep_running()) {
+        state.pause_timing();
+        io::delete_folder(target);
+        state.resume_timing();
+
+        io::ifstream in {file};
+        if (!io::unzip(in, target)) {
+            state.skip_with_error("unzip failed");
+            break;
+        }
+    }
+
+    state.set_items_processed(state.iterations() * ZipFileCount);
+    io::delete_folder(target);
+    io::delete_file(file);
+}
+
+BENCHMARK_CASE("IO.FileSystem.ReadFiles")
+{
+    auto const               found {io::enumerate("testfiles/", {.String = "*"}, true)};
+    std::vector<std::string> files(found.begin(), found.end());
+    if (files.empty()) {
+        state.skip_with_error("no test files");
+        return;
+    }
+
+    i64 fileBytes {0};
+    for (auto const& file : files) { fileBytes += static_cast<i64>(io::get_file_size(file)); }
+
+    while (state.keep_running()) {
+        for (auto const& file : files) {
+            io::ifstream    fs {file};
+            std::vector<u8> data {fs.read_all<u8>()};
+            bench::do_not_optimize(data);
+        }
+    }
+
+    state.set_bytes_processed(state.iterations() * fileBytes);
+    state.set_items_processed(state.iterations() * std::ssize(files));
+}
+
+BENCHMARK_CASE("IO.FileSystem.Enumerate")
+{
+    std::string const root {"benchEnumFolder"};
+    io::delete_folder(root);
+    io::create_folder(root);
+
+    i32 fileCount {0};
+    for (i32 d {0}; d < 20; ++d) {
+        std::string const dir {std::format("{}/mod{}", root, d)};
+        io::create_folder(dir);
+        for (i32 s {0}; s < 10; ++s) {
+            std::string const subDir {std::format("{}/sub{}", dir, s)};
+            io::create_folder(subDir);
+            for (i32 f {0}; f < 50; ++f) {
+                io::create_file(std::format("{}/file{}{}", subDir, f, f % 2 == 0 ? ".json" : ".txt"));
+                ++fileCount;
+            }
+        }
+    }
+
+    while (state.keep_running()) {
+        auto files {io::enumerate(root, {.String = "*.json"}, true)};
+        bench::do_not_optimize(files);
+    }
+
+    state.set_items_processed(state.iterations() * fileCount);
+    io::delete_folder(root);
+}
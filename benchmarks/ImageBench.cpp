@@ -0,0 +1,77 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+static bool const RegisterImageLoad {[] {
+    for (std::string const ext : std::array {"bmp", "bsi", "gif", "pcx", "png", "qoi", "tga"}) {
+        bench::register_benchmark("GFX.Image.Load." + ext, [ext](bench::state& state) {
+            auto const               found {io::enumerate("testfiles/" + ext + "/", {.String = "*." + ext}, false)};
+            std::vector<std::string> files(found.begin(), found.end());
+            if (files.empty()) {
+                state.skip_with_error("no test files for ." + ext);
+                return;
+            }
+
+            i64 fileBytes {0};
+            for (auto const& file : files) {
+                if (!image::Load(file)) {
+                    state.skip_with_error("could not load " + file);
+                    return;
+                }
+                fileBytes += static_cast<i64>(io::get_file_size(file));
+            }
+
+            while (state.keep_running()) {
+                for (auto const& file : files) {
+                    auto img {image::Load(file)};
+                    bench::do_not_optimize(img);
+                }
+            }
+
+            state.set_bytes_processed(state.iterations() * fileBytes);
+            state.set_items_processed(state.iterations() * std::ssize(files));
+        });
+    }
+    return true;
+}()};
+
+static bool const RegisterImageDecode {[] {
+    for (std::string const ext : std::array {".png", ".qoi", ".tga", ".bsi"}) {
+        bench::register_benchmark("GFX.Image.Decode" + ext, [ext](bench::state& state) {
+            image src {image::CreateEmpty({512, 512}, image::format::RGBA)};
+            auto  srcData {src.data()};
+            for (usize i {0}; i < srcData.size(); ++i) {
+                srcData[i] = static_cast<u8>((i / 4 % 512) ^ (i / 2048));
+            }
+
+            io::iomstream stream {};
+            if (!src.save(stream, ext)) {
+                state.skip_with_error("could not encode " + ext);
+                return;
+            }
+            auto const streamBytes {static_cast<i64>(stream.size_in_bytes())};
+
+            stream.seek(0, io::seek_dir::Begin);
+            if (auto const img {image::Load(stream, ext)}; !img || !std::ranges::equal(img->data(), srcData)) {
+                state.skip_with_error("could not decode " + ext);
+                return;
+            }
+
+            while (state.keep_running()) {
+                stream.seek(0, io::seek_dir::Begin);
+                auto img {image::Load(stream, ext)};
+                if (!img) {
+                    state.skip_with_error("could not decode " + ext);
+                    break;
+                }
+                bench::do_not_optimize(img);
+            }
+
+            state.set_bytes_processed(state.iterations() * streamBytes);
+        });
+    }
+    return true;
+}()};
@@ -0,0 +1,37 @@
+#include "bench.hpp"
+
+#include <array>
+#include <vector>
+
+struct bench_value_3d {
+    std::array<f64, 3> Position;
+    u32                ID;
+
+    auto get_dimensions() const -> std::array<f64, 3> { return Position; }
+    auto operator==(bench_value_3d const& other) const -> bool { return ID == other.ID; }
+};
+
+BENCHMARK_CASE("Core.KDTree.FindNearest")
+{
+    using tree_3d = kd_tree<bench_value_3d, 3, 2, 8>;
+
+    rng     rnd {12345};
+    tree_3d tree {tree_3d::bounds_type {{0, 0, 0}, {255, 255, 255}}};
+    for (u32 i {0}; i < 10'000; ++i) {
+        tree.add({.Position = {rnd(0.0, 255.0), rnd(0.0, 255.0), rnd(0.0, 255.0)}, .ID = i});
+    }
+
+    std::vector<std::array<f64, 3>> queries;
+    for (i32 i {0}; i < 256; ++i) {
+        queries.push_back({rnd(0.0, 255.0), rnd(0.0, 255.0), rnd(0.0, 255.0)});
+    }
+
+    while (state.keep_running()) {
+        for (auto const& q : queries) {
+            auto nearest {tree.find_nearest(q)};
+            bench::do_not_optimize(nearest);
+        }
+    }
+
+    state.set_items_processed(state.iterations() * std::ssize(queries));
+}
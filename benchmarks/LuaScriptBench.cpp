@@ -0,0 +1,29 @@
+#include "bench.hpp"
+
+using namespace tcob::scripting;
+
+class bench_script : public script {
+public:
+    bench_script()
+    {
+        open_libraries();
+    }
+
+    using script::run;
+};
+
+BENCHMARK_CASE("Script.Lua.Run")
+{
+    bench_script lua;
+
+    while (state.keep_running()) {
+        auto res {lua.run<i64>("local s = 0 for i = 1, 1000 do s = s + i end return s")};
+        if (!res) {
+            state.skip_with_error("script failed");
+            break;
+        }
+        bench::do_not_optimize(res);
+    }
+
+    state.set_items_processed(state.iterations());
+}
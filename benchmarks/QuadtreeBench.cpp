@@ -0,0 +1,44 @@
+#include "bench.hpp"
+
+#include <vector>
+
+struct bench_rect {
+    rect_f Bounds;
+    u32    ID {0};
+
+    auto get_rect() const -> rect_f const& { return Bounds; }
+    auto operator==(bench_rect const& other) const -> bool { return ID == other.ID; }
+};
+
+template <>
+struct std::hash<bench_rect> {
+    auto operator()(bench_rect const& r) const -> std::size_t
+    {
+        return std::hash<u32> {}(r.ID);
+    }
+};
+
+BENCHMARK_CASE("Core.Quadtree.Query")
+{
+    f32 const worldSize {1000.f};
+
+    rng                  rnd {12345};
+    quadtree<bench_rect> tree {rect_f {0, 0, worldSize, worldSize}};
+    for (u32 i {0}; i < 10'000; ++i) {
+        tree.add(bench_rect {.Bounds = {rnd(0.f, worldSize - 10.f), rnd(0.f, worldSize - 10.f), rnd(1.f, 10.f), rnd(1.f, 10.f)}, .ID = i});
+    }
+
+    std::vector<rect_f> queries;
+    for (i32 i {0}; i < 256; ++i) {
+        queries.push_back(rect_f {rnd(0.f, worldSize - 50.f), rnd(0.f, worldSize - 50.f), 50.f, 50.f});
+    }
+
+    while (state.keep_running()) {
+        for (auto const& q : queries) {
+            auto result {tree.query(q)};
+            bench::do_not_optimize(result);
+        }
+    }
+
+    state.set_items_processed(state.iterations() * std::ssize(queries));
+}
@@ -0,0 +1,19 @@
+#include "bench.hpp"
+
+BENCHMARK_CASE("Core.Signal.Emit")
+{
+    signal<i32 const, void> sig0;
+
+    i32 sum {0};
+    for (i32 i {0}; i < 8; ++i) {
+        sig0.connect([&sum](i32 val) { sum += val; });
+    }
+
+    i32 value {0};
+    while (state.keep_running()) {
+        emit_signal(sig0, value++);
+    }
+    bench::do_not_optimize(sum);
+
+    state.set_items_processed(state.iterations());
+}
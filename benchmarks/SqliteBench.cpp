@@ -0,0 +1,42 @@
+#include "bench.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace tcob::db;
+
+BENCHMARK_CASE("Data.Sqlite.SelectWhere")
+{
+    i32 const rowCount {10'000};
+
+    database db {database::OpenMemory()};
+    auto     dbTable {db.create_table("benchTable",
+                                      int_column<primary_key> {.Name = "ID", .NotNull = true},
+                                      text_column {.Name = "Name", .NotNull = true},
+                                      int_column {.Name = "Age"},
+                                      real_column {.Name = "Height"},
+                                      int_column {.Name = "Alive"})};
+    if (!dbTable) {
+        state.skip_with_error("could not create table");
+        return;
+    }
+
+    std::vector<std::tuple<i32, std::string, i32, f32, bool>> vec;
+    for (i32 i {1}; i <= rowCount; ++i) {
+        vec.emplace_back(i, std::to_string(i), i * 100, static_cast<f32>(i) * 1.5f, i % 2 == 0);
+    }
+    if (!dbTable->insert_into("ID", "Name", "Age", "Height", "Alive")(vec)) {
+        state.skip_with_error("could not insert rows");
+        return;
+    }
+
+    // primary key lookups, so building the SQL and preparing the statement dominate
+    i32 id {0};
+    while (state.keep_running()) {
+        auto const rows {dbTable->select_from<i32, std::string, i32, f32, bool>().where(equal {"ID"})(id++ % rowCount + 1)};
+        bench::do_not_optimize(rows);
+    }
+
+    state.set_items_processed(state.iterations());
+}
@@ -0,0 +1,235 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+static auto make_payload(usize size) -> std::vector<u8>
+{
+    std::vector<u8> retValue(size);
+    for (usize i {0}; i < size; ++i) {
+        retValue[i] = static_cast<u8>((i * 131) ^ (i >> 7));
+    }
+    return retValue;
+}
+
+static auto matches_payload(std::vector<std::byte> const& data, std::vector<u8> const& payload) -> bool
+{
+    return std::ranges::equal(data, std::as_bytes(std::span {payload}));
+}
+
+usize const PayloadSize {64 * 1024 * 1024};
+
+BENCHMARK_CASE("IO.Stream.ReadAll.ifstream")
+{
+    std::string const file {"bench.ReadAll"};
+    io::delete_file(file);
+    {
+        io::ofstream fs {file};
+        fs.write<u8>(make_payload(PayloadSize));
+    }
+    if (io::get_file_size(file) != PayloadSize) {
+        state.skip_with_error("could not write " + file);
+        io::delete_file(file);
+        return;
+    }
+    {
+        io::ifstream fs {file};
+        if (fs.read_all<u8>().size() != PayloadSize) {
+            state.skip_with_error("could not read " + file);
+            io::delete_file(file);
+            return;
+        }
+    }
+
+    while (state.keep_running()) {
+        io::ifstream    fs {file};
+        std::vector<u8> data {fs.read_all<u8>()};
+        bench::do_not_optimize(data);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(PayloadSize));
+    io::delete_file(file);
+}
+
+BENCHMARK_CASE("IO.Stream.ReadAll.isstream")
+{
+    auto const             payload {make_payload(PayloadSize)};
+    std::vector<std::byte> buffer(PayloadSize);
+    {
+        io::osstream fs {buffer};
+        fs.write<u8>(payload);
+    }
+
+    while (state.keep_running()) {
+        io::isstream    fs {buffer};
+        std::vector<u8> data {fs.read_all<u8>()};
+        bench::do_not_optimize(data);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(PayloadSize));
+}
+
+usize const FilterPayloadSize {16 * 1024 * 1024};
+
+BENCHMARK_CASE("IO.Stream.Filter.zlib.Write")
+{
+    auto const payload {make_payload(FilterPayloadSize)};
+
+    while (state.keep_running()) {
+        io::iomstream stream {};
+        if (stream.write_filtered(std::as_bytes(std::span {payload}), io::zlib_filter {}) == -1) {
+            state.skip_with_error("compression failed");
+            break;
+        }
+        bench::do_not_optimize(stream);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+}
+
+BENCHMARK_CASE("IO.Stream.Filter.zlib.Read")
+{
+    auto const    payload {make_payload(FilterPayloadSize)};
+    io::iomstream stream {};
+    if (stream.write_filtered(std::as_bytes(std::span {payload}), io::zlib_filter {}) == -1) {
+        state.skip_with_error("compression failed");
+        return;
+    }
+    auto const compressedSize {stream.size_in_bytes()};
+
+    stream.seek(0, io::seek_dir::Begin);
+    if (!matches_payload(stream.read_filtered(compressedSize, io::zlib_filter {}), payload)) {
+        state.skip_with_error("decompression failed");
+        return;
+    }
+
+    while (state.keep_running()) {
+        stream.seek(0, io::seek_dir::Begin);
+        auto data {stream.read_filtered(compressedSize, io::zlib_filter {})};
+        bench::do_not_optimize(data);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+}
+
+static bool const RegisterTextFilters {[] {
+    auto const add {[](std::string const& name, auto filter) {
+        bench::register_benchmark("IO.Stream.Filter." + name + ".Encode", [filter, name](bench::state& state) {
+            auto const payload {make_payload(FilterPayloadSize)};
+
+            while (state.keep_running()) {
+                io::iomstream stream {};
+                if (stream.write_filtered(std::as_bytes(std::span {payload}), filter) == -1) {
+                    state.skip_with_error(name + " encoding failed");
+                    break;
+                }
+                bench::do_not_optimize(stream);
+            }
+
+            state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+        });
+
+        bench::register_benchmark("IO.Stream.Filter." + name + ".Decode", [filter, name](bench::state& state) {
+            auto const    payload {make_payload(FilterPayloadSize)};
+            io::iomstream stream {};
+            if (stream.write_filtered(std::as_bytes(std::span {payload}), filter) == -1) {
+                state.skip_with_error(name + " encoding failed");
+                return;
+            }
+            auto const encodedSize {stream.size_in_bytes()};
+
+            stream.seek(0, io::seek_dir::Begin);
+            if (!matches_payload(stream.read_filtered(encodedSize, filter), payload)) {
+                state.skip_with_error(name + " decoding failed");
+                return;
+            }
+
+            while (state.keep_running()) {
+                stream.seek(0, io::seek_dir::Begin);
+                auto data {stream.read_filtered(encodedSize, filter)};
+                bench::do_not_optimize(data);
+            }
+
+            state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+            state.set_label("encoded " + std::to_string(encodedSize) + " bytes");
+        });
+    }};
+
+    add("base64", io::base64_filter {});
+    add("z85", io::z85_filter {});
+    return true;
+}()};
+
+BENCHMARK_CASE("IO.Stream.Filter.Chain.Write")
+{
+    auto const payload {make_payload(FilterPayloadSize)};
+
+    while (state.keep_running()) {
+        io::iomstream stream {};
+        if (stream.write_filtered(std::as_bytes(std::span {payload}), io::zlib_filter {}, io::base64_filter {}, io::reverser_filter {}) == -1) {
+            state.skip_with_error("chain encoding failed");
+            break;
+        }
+        bench::do_not_optimize(stream);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+}
+
+BENCHMARK_CASE("IO.Stream.Filter.Chain.Read")
+{
+    auto const    payload {make_payload(FilterPayloadSize)};
+    io::iomstream stream {};
+    if (stream.write_filtered(std::as_bytes(std::span {payload}), io::zlib_filter {}, io::base64_filter {}, io::reverser_filter {}) == -1) {
+        state.skip_with_error("chain encoding failed");
+        return;
+    }
+    auto const encodedSize {stream.size_in_bytes()};
+
+    // no test pins the read order for non-commuting filters, so verify it here
+    stream.seek(0, io::seek_dir::Begin);
+    if (!matches_payload(stream.read_filtered(encodedSize, io::zlib_filter {}, io::base64_filter {}, io::reverser_filter {}), payload)) {
+        state.skip_with_error("chain decoding does not round-trip");
+        return;
+    }
+
+    while (state.keep_running()) {
+        stream.seek(0, io::seek_dir::Begin);
+        auto data {stream.read_filtered(encodedSize, io::zlib_filter {}, io::base64_filter {}, io::reverser_filter {})};
+        bench::do_not_optimize(data);
+    }
+
+    state.set_bytes_processed(state.iterations() * static_cast<i64>(FilterPayloadSize));
+}
+
+BENCHMARK_CASE("IO.Magic.GetSignature")
+{
+    std::vector<std::vector<std::byte>> buffers;
+    for (auto const& file : io::enumerate("testfiles/", {.String = "*"}, true)) {
+        io::ifstream fs {file};
+        auto const   data {fs.read_all<u8>()};
+        auto const   bytes {std::as_bytes(std::span {data})};
+        buffers.emplace_back(bytes.begin(), bytes.end());
+    }
+    if (buffers.empty()) {
+        state.skip_with_error("no test files");
+        return;
+    }
+
+    std::vector<std::unique_ptr<io::isstream>> streams;
+    streams.reserve(buffers.size());
+    for (auto& buffer : buffers) { streams.push_back(std::make_unique<io::isstream>(buffer)); }
+
+    while (state.keep_running()) {
+        for (auto& stream : streams) {
+            stream->seek(0, io::seek_dir::Begin);
+            auto sig {io::magic::get_signature(*stream)};
+            bench::do_not_optimize(sig);
+        }
+    }
+
+    state.set_items_processed(state.iterations() * std::ssize(streams));
+}
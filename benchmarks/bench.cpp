@@ -0,0 +1,667 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <print>
+#include <string_view>
+#include <thread>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+namespace bench {
+
+////////////////////////////////////////////////////////////
+
+// CPU time of the calling thread, matching google-benchmark's cpu_time
+static auto thread_cpu_seconds() -> f64
+{
+#if defined(_WIN32)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) { return 0; }
+
+    auto const toTicks {[](FILETIME const& ft) {
+        return (static_cast<u64>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    }};
+    return static_cast<f64>(toTicks(kernelTime) + toTicks(userTime)) * 1e-7; // 100ns ticks
+#else
+    timespec ts {};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) { return 0; }
+    return static_cast<f64>(ts.tv_sec) + static_cast<f64>(ts.tv_nsec) * 1e-9;
+#endif
+}
+
+////////////////////////////////////////////////////////////
+
+state::state(i64 maxIterations)
+    : _maxIterations {maxIterations}
+{
+}
+
+auto state::keep_running() -> bool
+{
+    if (_finished) { return false; }
+
+    if (_iteration == 0 && !_running) {
+        if (has_error()) {
+            _finished = true;
+            return false;
+        }
+        resume_timing();
+    }
+
+    if (_iteration < _maxIterations && !has_error()) {
+        ++_iteration;
+        return true;
+    }
+
+    if (_running) { pause_timing(); }
+    _finished = true;
+    return false;
+}
+
+void state::pause_timing()
+{
+    if (!_running) { return; }
+
+    _realSeconds += std::chrono::duration<f64> {clock::now() - _realStart}.count();
+    _cpuSeconds += thread_cpu_seconds() - _cpuStart;
+    _running = false;
+}
+
+void state::resume_timing()
+{
+    if (_running) { return; }
+
+    _cpuStart  = thread_cpu_seconds();
+    _realStart = clock::now();
+    _running   = true;
+}
+
+void state::set_bytes_processed(i64 bytes)
+{
+    _bytesProcessed = bytes;
+}
+
+void state::set_items_processed(i64 items)
+{
+    _itemsProcessed = items;
+}
+
+void state::set_label(std::string label)
+{
+    _label = std::move(label);
+}
+
+void state::skip_with_error(std::string message)
+{
+    _error = std::move(message);
+    if (_error.empty()) { _error = "skipped"; }
+}
+
+auto state::iterations() const -> i64
+{
+    return _iteration;
+}
+
+auto state::max_iterations() const -> i64
+{
+    return _maxIterations;
+}
+
+auto state::real_seconds() const -> f64
+{
+    return _realSeconds;
+}
+
+auto state::cpu_seconds() const -> f64
+{
+    return _cpuSeconds;
+}
+
+auto state::bytes_processed() const -> i64
+{
+    return _bytesProcessed;
+}
+
+auto state::items_processed() const -> i64
+{
+    return _itemsProcessed;
+}
+
+auto state::label() const -> std::string const&
+{
+    return _label;
+}
+
+auto state::error() const -> std::string const&
+{
+    return _error;
+}
+
+auto state::has_error() const -> bool
+{
+    return !_error.empty();
+}
+
+////////////////////////////////////////////////////////////
+
+namespace {
+
+    struct registered_benchmark {
+        std::string Name;
+        function    Function;
+    };
+
+    auto registry() -> std::vector<registered_benchmark>&
+    {
+        static std::vector<registered_benchmark> retValue;
+        return retValue;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    struct run_result {
+        std::string Name;
+        std::string RunType {"iteration"};
+        std::string AggregateName;
+        i64         Iterations {0};
+        f64         RealTime {0}; // ns per iteration
+        f64         CpuTime {0};  // ns per iteration
+        f64         BytesPerSecond {0};
+        f64         ItemsPerSecond {0};
+        std::string Label;
+        std::string Error;
+    };
+
+    struct options {
+        std::string Filter {"*"};
+        std::string Format {"console"};
+        std::string OutFile;
+        std::string OutFormat {"json"};
+        f64         MinTime {0.5};
+        i32         Repetitions {1};
+        bool        List {false};
+    };
+
+    i64 const MaxIterations {1'000'000'000};
+
+    ////////////////////////////////////////////////////////////
+
+    auto wildcard_match(std::string_view pattern, std::string_view str) -> bool
+    {
+        usize p {0}, s {0};
+        usize star {std::string_view::npos}, mark {0};
+
+        while (s < str.size()) {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s])) {
+                ++p;
+                ++s;
+            } else if (p < pattern.size() && pattern[p] == '*') {
+                star = p++;
+                mark = s;
+            } else if (star != std::string_view::npos) {
+                p = star + 1;
+                s = ++mark;
+            } else {
+                return false;
+            }
+        }
+
+        while (p < pattern.size() && pattern[p] == '*') { ++p; }
+        return p == pattern.size();
+    }
+
+    auto matches_filter(std::string_view filter, std::string_view name) -> bool
+    {
+        // comma separated list of wildcard patterns, like doctest's -tc
+        while (!filter.empty()) {
+            usize const            comma {filter.find(',')};
+            std::string_view const pattern {filter.substr(0, comma)};
+            if (wildcard_match(pattern, name)) { return true; }
+            if (comma == std::string_view::npos) { break; }
+            filter.remove_prefix(comma + 1);
+        }
+        return false;
+    }
+
+    auto parse_options(int argc, char** argv) -> std::optional<options>
+    {
+        options retValue;
+
+        for (int i {1}; i < argc; ++i) {
+            std::string_view const arg {argv[i]};
+
+            auto const value {[&](std::string_view key) -> std::optional<std::string_view> {
+                if (arg.starts_with(key) && arg.size() > key.size() && arg[key.size()] == '=') {
+                    return arg.substr(key.size() + 1);
+                }
+                return std::nullopt;
+            }};
+
+            if (arg == "--list") {
+                retValue.List = true;
+            } else if (auto filter {value("--filter")}) {
+                retValue.Filter = *filter;
+            } else if (auto format {value("--format")}) {
+                retValue.Format = *format;
+            } else if (auto out {value("--out")}) {
+                retValue.OutFile = *out;
+            } else if (auto outFormat {value("--out-format")}) {
+                retValue.OutFormat = *outFormat;
+            } else if (auto minTime {value("--min-time")}) {
+                if (std::from_chars(minTime->data(), minTime->data() + minTime->size(), retValue.MinTime).ec != std::errc {}
+                    || retValue.MinTime <= 0) {
+                    std::println(stderr, "Error: invalid value for --min-time: '{}'", *minTime);
+                    return std::nullopt;
+                }
+            } else if (auto reps {value("--repetitions")}) {
+                if (std::from_chars(reps->data(), reps->data() + reps->size(), retValue.Repetitions).ec != std::errc {}
+                    || retValue.Repetitions < 1) {
+                    std::println(stderr, "Error: invalid value for --repetitions: '{}'", *reps);
+                    return std::nullopt;
+                }
+            } else {
+                std::println(stderr, "Usage: tcob_bench [--list] [--filter=<pattern>[,<pattern>...]] [--format=console|json|csv]");
+                std::println(stderr, "                  [--out=<file>] [--out-format=json|csv] [--min-time=<seconds>] [--repetitions=<n>]");
+                return std::nullopt;
+            }
+        }
+
+        auto const validFormat {[](std::string_view f) { return f == "console" || f == "json" || f == "csv"; }};
+        if (!validFormat(retValue.Format) || !validFormat(retValue.OutFormat)) {
+            std::println(stderr, "Error: unknown output format");
+            return std::nullopt;
+        }
+
+        return retValue;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    auto make_result(std::string const& name, state const& st) -> run_result
+    {
+        run_result retValue;
+        retValue.Name       = name;
+        retValue.Iterations = st.iterations();
+        retValue.Label      = st.label();
+        retValue.Error      = st.error();
+
+        if (st.iterations() > 0) {
+            auto const iterations {static_cast<f64>(st.iterations())};
+            retValue.RealTime = st.real_seconds() * 1e9 / iterations;
+            retValue.CpuTime  = st.cpu_seconds() * 1e9 / iterations;
+        }
+        if (st.real_seconds() > 0) {
+            retValue.BytesPerSecond = static_cast<f64>(st.bytes_processed()) / st.real_seconds();
+            retValue.ItemsPerSecond = static_cast<f64>(st.items_processed()) / st.real_seconds();
+        }
+
+        return retValue;
+    }
+
+    auto run_once(registered_benchmark const& bm, i64 iterations) -> state
+    {
+        state retValue {iterations};
+        try {
+            bm.Function(retValue);
+        } catch (std::exception const& ex) {
+            retValue.skip_with_error(ex.what());
+        } catch (...) {
+            retValue.skip_with_error("unknown exception");
+        }
+        return retValue;
+    }
+
+    auto run_benchmark(registered_benchmark const& bm, options const& opts) -> std::vector<run_result>
+    {
+        std::vector<run_result> retValue;
+
+        // find an iteration count that runs for at least MinTime
+        i64   iterations {1};
+        state st {run_once(bm, iterations)};
+        while (!st.has_error()) {
+            f64 const seconds {st.real_seconds()};
+            if (seconds >= opts.MinTime || iterations >= MaxIterations) { break; }
+
+            f64 multiplier {opts.MinTime * 1.4 / std::max(seconds, 1e-9)};
+            if (seconds / opts.MinTime <= 0.1) { multiplier = std::min(multiplier, 10.0); }
+
+            i64 const next {static_cast<i64>(std::round(static_cast<f64>(iterations) * multiplier))};
+            iterations = std::clamp(next, iterations + 1, MaxIterations);
+            st         = run_once(bm, iterations);
+        }
+
+        retValue.push_back(make_result(bm.Name, st));
+        if (st.has_error()) { return retValue; }
+
+        for (i32 rep {1}; rep < opts.Repetitions; ++rep) {
+            state const next {run_once(bm, iterations)};
+            retValue.push_back(make_result(bm.Name, next));
+            if (next.has_error()) { return retValue; }
+        }
+
+        if (opts.Repetitions > 1) {
+            auto const aggregate {[&](std::string const& aggName, auto&& reduce) {
+                run_result agg {retValue[0]};
+                agg.Name           = bm.Name + "_" + aggName;
+                agg.RunType        = "aggregate";
+                agg.AggregateName  = aggName;
+                agg.Iterations     = opts.Repetitions;
+                agg.RealTime       = reduce(&run_result::RealTime);
+                agg.CpuTime        = reduce(&run_result::CpuTime);
+                agg.BytesPerSecond = reduce(&run_result::BytesPerSecond);
+                agg.ItemsPerSecond = reduce(&run_result::ItemsPerSecond);
+                return agg;
+            }};
+
+            std::vector<run_result> const runs {retValue};
+            auto const                    collect {[&](f64 run_result::* member) {
+                std::vector<f64> values;
+                values.reserve(runs.size());
+                for (auto const& run : runs) { values.push_back(run.*member); }
+                return values;
+            }};
+
+            auto const mean {[&](f64 run_result::* member) {
+                auto const values {collect(member)};
+                return std::accumulate(values.begin(), values.end(), 0.0) / static_cast<f64>(values.size());
+            }};
+            auto const median {[&](f64 run_result::* member) {
+                auto values {collect(member)};
+                std::ranges::sort(values);
+                usize const mid {values.size() / 2};
+                return values.size() % 2 == 0 ? (values[mid - 1] + values[mid]) / 2.0 : values[mid];
+            }};
+            auto const stddev {[&](f64 run_result::* member) {
+                auto const values {collect(member)};
+                f64 const  avg {mean(member)};
+                f64        sum {0};
+                for (f64 const v : values) { sum += (v - avg) * (v - avg); }
+                return std::sqrt(sum / static_cast<f64>(values.size() - 1));
+            }};
+
+            retValue.push_back(aggregate("mean", mean));
+            retValue.push_back(aggregate("median", median));
+            retValue.push_back(aggregate("stddev", stddev));
+        }
+
+        return retValue;
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    auto escape_json(std::string_view str) -> std::string
+    {
+        std::string retValue;
+        retValue.reserve(str.size());
+        for (char const c : str) {
+            switch (c) {
+            case '"': retValue += "\\\""; break;
+            case '\\': retValue += "\\\\"; break;
+            case '\n': retValue += "\\n"; break;
+            case '\r': retValue += "\\r"; break;
+            case '\t': retValue += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    retValue += std::format("\\u{:04x}", static_cast<u32>(c));
+                } else {
+                    retValue += c;
+                }
+                break;
+            }
+        }
+        return retValue;
+    }
+
+    auto escape_csv(std::string_view str) -> std::string
+    {
+        if (str.find_first_of(",\"\n") == std::string_view::npos) { return std::string {str}; }
+
+        std::string retValue {"\""};
+        for (char const c : str) {
+            if (c == '"') { retValue += '"'; }
+            retValue += c;
+        }
+        retValue += '"';
+        return retValue;
+    }
+
+    auto format_rate(f64 value, std::string_view unit) -> std::string
+    {
+        if (value <= 0) { return ""; }
+
+        std::array<std::string_view, 5> const prefixes {"", "k", "M", "G", "T"};
+        usize                                 idx {0};
+        while (value >= 1000.0 && idx < prefixes.size() - 1) {
+            value /= 1000.0;
+            ++idx;
+        }
+        return std::format("{:.3g}{}{}/s", value, prefixes[idx], unit);
+    }
+
+    ////////////////////////////////////////////////////////////
+
+    class reporter {
+    public:
+        virtual ~reporter() = default;
+
+        virtual void begin(std::string_view executable)          = 0;
+        virtual void report(std::vector<run_result> const& runs) = 0;
+        virtual void end()                                       = 0;
+    };
+
+    class console_reporter final : public reporter {
+    public:
+        explicit console_reporter(std::ostream& os)
+            : _os {os}
+        {
+        }
+
+        void begin(std::string_view) override
+        {
+            std::println(_os, "{:<60} {:>15} {:>15} {:>12} {:>12} {:>12}", "Benchmark", "Time", "CPU", "Iterations", "Bytes", "Items");
+            std::println(_os, "{}", std::string(131, '-'));
+        }
+
+        void report(std::vector<run_result> const& runs) override
+        {
+            for (auto const& run : runs) {
+                if (!run.Error.empty()) {
+                    std::println(_os, "{:<60} ERROR: {}", run.Name, run.Error);
+                    continue;
+                }
+                std::println(_os, "{:<60} {:>12.0f} ns {:>12.0f} ns {:>12} {:>12} {:>12} {}",
+                             run.Name, run.RealTime, run.CpuTime, run.Iterations,
+                             format_rate(run.BytesPerSecond, "B"), format_rate(run.ItemsPerSecond, ""), run.Label);
+            }
+            _os.flush();
+        }
+
+        void end() override { }
+
+    private:
+        std::ostream& _os;
+    };
+
+    class json_reporter final : public reporter {
+    public:
+        explicit json_reporter(std::ostream& os)
+            : _os {os}
+        {
+        }
+
+        void begin(std::string_view executable) override
+        {
+#if defined(NDEBUG)
+            std::string_view const buildType {"release"};
+#else
+            std::string_view const buildType {"debug"};
+#endif
+            auto const now {std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now())};
+
+            std::println(_os, "{{");
+            std::println(_os, "  \"context\": {{");
+            std::println(_os, "    \"date\": \"{:%FT%TZ}\",", now);
+            std::println(_os, "    \"executable\": \"{}\",", escape_json(executable));
+            std::println(_os, "    \"num_cpus\": {},", std::thread::hardware_concurrency());
+            std::println(_os, "    \"library_build_type\": \"{}\"", buildType);
+            std::println(_os, "  }},");
+            std::print(_os, "  \"benchmarks\": [");
+        }
+
+        void report(std::vector<run_result> const& runs) override
+        {
+            for (auto const& run : runs) {
+                std::print(_os, "{}\n    {{\n", _first ? "" : ",");
+                _first = false;
+
+                std::println(_os, "      \"name\": \"{}\",", escape_json(run.Name));
+                std::println(_os, "      \"run_type\": \"{}\",", run.RunType);
+                if (!run.AggregateName.empty()) {
+                    std::println(_os, "      \"aggregate_name\": \"{}\",", run.AggregateName);
+                }
+                if (!run.Error.empty()) {
+                    std::println(_os, "      \"error_occurred\": true,");
+                    std::println(_os, "      \"error_message\": \"{}\"", escape_json(run.Error));
+                    std::print(_os, "    }}");
+                    continue;
+                }
+                std::println(_os, "      \"iterations\": {},", run.Iterations);
+                std::println(_os, "      \"real_time\": {},", run.RealTime);
+                std::println(_os, "      \"cpu_time\": {},", run.CpuTime);
+                if (run.BytesPerSecond > 0) { std::println(_os, "      \"bytes_per_second\": {},", run.BytesPerSecond); }
+                if (run.ItemsPerSecond > 0) { std::println(_os, "      \"items_per_second\": {},", run.ItemsPerSecond); }
+                if (!run.Label.empty()) { std::println(_os, "      \"label\": \"{}\",", escape_json(run.Label)); }
+                std::println(_os, "      \"time_unit\": \"ns\"");
+                std::print(_os, "    }}");
+            }
+        }
+
+        void end() override
+        {
+            std::println(_os, "\n  ]");
+            std::println(_os, "}}");
+            _os.flush();
+        }
+
+    private:
+        std::ostream& _os;
+        bool          _first {true};
+    };
+
+    class csv_reporter final : public reporter {
+    public:
+        explicit csv_reporter(std::ostream& os)
+            : _os {os}
+        {
+        }
+
+        void begin(std::string_view) override
+        {
+            std::println(_os, "name,iterations,real_time,cpu_time,time_unit,bytes_per_second,items_per_second,label,error_occurred,error_message");
+        }
+
+        void report(std::vector<run_result> const& runs) override
+        {
+            for (auto const& run : runs) {
+                if (!run.Error.empty()) {
+                    std::println(_os, "{},,,,,,,,true,{}", escape_csv(run.Name), escape_csv(run.Error));
+                    continue;
+                }
+                std::println(_os, "{},{},{},{},ns,{},{},{},,",
+                             escape_csv(run.Name), run.Iterations, run.RealTime, run.CpuTime,
+                             run.BytesPerSecond > 0 ? std::format("{}", run.BytesPerSecond) : "",
+                             run.ItemsPerSecond > 0 ? std::format("{}", run.ItemsPerSecond) : "",
+                             escape_csv(run.Label));
+            }
+            _os.flush();
+        }
+
+        void end() override { }
+
+    private:
+        std::ostream& _os;
+    };
+
+    auto make_reporter(std::string_view format, std::ostream& os) -> std::unique_ptr<reporter>
+    {
+        if (format == "json") { return std::make_unique<json_reporter>(os); }
+        if (format == "csv") { return std::make_unique<csv_reporter>(os); }
+        return std::make_unique<console_reporter>(os);
+    }
+
+}
+
+////////////////////////////////////////////////////////////
+
+auto register_benchmark(std::string name, function func) -> bool
+{
+    registry().push_back({.Name = std::move(name), .Function = std::move(func)});
+    return true;
+}
+
+auto run(int argc, char** argv) -> int
+{
+    auto const opts {parse_options(argc, argv)};
+    if (!opts) { return 1; }
+
+    std::vector<registered_benchmark const*> selected;
+    for (auto const& bm : registry()) {
+        if (matches_filter(opts->Filter, bm.Name)) { selected.push_back(&bm); }
+    }
+    std::ranges::stable_sort(selected, {}, &registered_benchmark::Name);
+
+    if (opts->List) {
+        for (auto const* bm : selected) { std::println("{}", bm->Name); }
+        return 0;
+    }
+
+    if (selected.empty()) {
+        std::println(stderr, "Error: no benchmark matches '{}'", opts->Filter);
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<reporter>> reporters;
+    reporters.push_back(make_reporter(opts->Format, std::cout));
+
+    std::ofstream outFile;
+    if (!opts->OutFile.empty()) {
+        outFile.open(opts->OutFile, std::ios::out | std::ios::trunc);
+        if (!outFile) {
+            std::println(stderr, "Error: could not open '{}'", opts->OutFile);
+            return 1;
+        }
+        reporters.push_back(make_reporter(opts->OutFormat, outFile));
+    }
+
+    std::string_view const executable {argc > 0 ? argv[0] : "tcob_bench"};
+    for (auto& rep : reporters) { rep->begin(executable); }
+
+    bool failed {false};
+    for (auto const* bm : selected) {
+        auto const runs {run_benchmark(*bm, *opts)};
+        failed |= std::ranges::any_of(runs, [](auto const& r) { return !r.Error.empty(); });
+        for (auto& rep : reporters) { rep->report(runs); }
+    }
+
+    for (auto& rep : reporters) { rep->end(); }
+
+    return failed ? 1 : 0;
+}
+
+}
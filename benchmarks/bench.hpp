@@ -0,0 +1,98 @@
+#pragma once
+
+// IWYU pragma: always_keep
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "tests.hpp"
+
+namespace bench {
+
+////////////////////////////////////////////////////////////
+
+class state final {
+public:
+    explicit state(i64 maxIterations);
+
+    // Drives the timed loop: while (state.keep_running()) { ... }
+    auto keep_running() -> bool;
+
+    void pause_timing();
+    void resume_timing();
+
+    // Totals over all iterations, like google-benchmark.
+    void set_bytes_processed(i64 bytes);
+    void set_items_processed(i64 items);
+    void set_label(std::string label);
+
+    void skip_with_error(std::string message);
+
+    auto iterations() const -> i64;
+    auto max_iterations() const -> i64;
+
+    auto real_seconds() const -> f64;
+    auto cpu_seconds() const -> f64;
+    auto bytes_processed() const -> i64;
+    auto items_processed() const -> i64;
+    auto label() const -> std::string const&;
+    auto error() const -> std::string const&;
+    auto has_error() const -> bool;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    i64 _maxIterations;
+    i64 _iteration {0};
+
+    bool              _running {false};
+    bool              _finished {false};
+    clock::time_point _realStart {};
+    f64               _cpuStart {0};
+    f64               _realSeconds {0};
+    f64               _cpuSeconds {0};
+
+    i64         _bytesProcessed {0};
+    i64         _itemsProcessed {0};
+    std::string _label;
+    std::string _error;
+};
+
+////////////////////////////////////////////////////////////
+
+using function = std::function<void(state&)>;
+
+auto register_benchmark(std::string name, function func) -> bool;
+
+auto run(int argc, char** argv) -> int;
+
+////////////////////////////////////////////////////////////
+
+template <typename T>
+inline void do_not_optimize(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static char const volatile* volatile sink {nullptr};
+    sink = &reinterpret_cast<char const volatile&>(value);
+    std::atomic_signal_fence(std::memory_order_acq_rel);
+#endif
+}
+
+}
+
+////////////////////////////////////////////////////////////
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b)      BENCH_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_CASE_IMPL(name, func)                                                         \
+    static void       func(bench::state& state);                                                \
+    static bool const BENCH_CONCAT(func, _registered) {bench::register_benchmark(name, &func)}; \
+    static void       func(bench::state& state)
+
+#define BENCHMARK_CASE(name) BENCHMARK_CASE_IMPL(name, BENCH_CONCAT(bench_case_, __LINE__))
@@ -0,0 +1,8 @@
+#include "bench.hpp"
+
+auto main(int argc, char** argv) -> int
+{
+    auto pl {tcob::platform::HeadlessInit("tcob_bench.log")};
+
+    return bench::run(argc, argv);
+}